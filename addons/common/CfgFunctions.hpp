@@ -121,6 +121,8 @@ class CfgFunctions {
         class Misc {
             PATHTO_FNC(addPerFrameHandler);
             PATHTO_FNC(removePerFrameHandler);
+            PATHTO_FNC(enableProfiling);
+            PATHTO_FNC(dumpProfile);
             PATHTO_FNC(createPerFrameHandlerObject);
             PATHTO_FNC(deletePerFrameHandlerObject);
             PATHTO_FNC(addPlayerAction);
@@ -134,7 +136,9 @@ class CfgFunctions {
             PATHTO_FNC(execNextFrame);
             PATHTO_FNC(execAfterNFrames);
             PATHTO_FNC(waitAndExecute);
+            PATHTO_FNC(removeWaitAndExecute);
             PATHTO_FNC(waitUntilAndExecute);
+            PATHTO_FNC(removeWaitUntilAndExecute);
             PATHTO_FNC(compileFinal);
             PATHTO_FNC(createUUID);
             PATHTO_FNC(escapeRegex);
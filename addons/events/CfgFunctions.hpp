@@ -20,11 +20,14 @@ class CfgFunctions {
             PATHTO_FNC(globalEvent);
             PATHTO_FNC(globalEventJIP);
             PATHTO_FNC(removeGlobalEventJIP);
+            PATHTO_FNC(dumpGlobalEventJIP);
             PATHTO_FNC(serverEvent);
             PATHTO_FNC(remoteEvent);
             PATHTO_FNC(targetEvent);
             PATHTO_FNC(turretEvent);
             PATHTO_FNC(ownerEvent);
+            PATHTO_FNC(enableNetworkEventStats);
+            PATHTO_FNC(dumpNetworkEventStats);
             PATHTO_FNC(addMarkerEventHandler);
             PATHTO_FNC(removeMarkerEventHandler);
             PATHTO_FNC(registerChatCommand);
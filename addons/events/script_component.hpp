@@ -20,28 +20,84 @@
 #define EVENT_PVAR CBAs
 #define EVENT_PVAR_STR QUOTE(EVENT_PVAR)
 
+// network statistics, see CBA_fnc_enableNetworkEventStats
+#define SYS_RECORD_SEND(message,name,destination) if (GVAR(networkStatsEnabled)) then {\
+    [name, destination, message] call FUNC(recordNetworkEvent)\
+}
+
 #define SYS_SEND_EVENT(params,name,command) EVENT_PVAR = [name, params]; command EVENT_PVAR_STR
-#define SEND_EVENT_TO_OTHERS(params,name) SYS_SEND_EVENT(params,name,publicVariable)
-#define SEND_EVENT_TO_SERVER(params,name) SYS_SEND_EVENT(params,name,publicVariableServer)
-#define SEND_EVENT_TO_CLIENT(params,name,client) SYS_SEND_EVENT(params,name,client publicVariableClient)
+#define SEND_EVENT_TO_OTHERS(params,name) SYS_RECORD_SEND([ARR_2(name,params)],name,BATCH_TO_OTHERS);\
+if (GVAR(batchNetworkEvents)) then {\
+    [BATCH_TO_OTHERS, BATCH_TYPE_EVENT, [name, params]] call FUNC(sendEventBatched)\
+} else {\
+    SYS_SEND_EVENT(params,name,publicVariable)\
+}
+#define SEND_EVENT_TO_SERVER(params,name) SYS_RECORD_SEND([ARR_2(name,params)],name,BATCH_TO_SERVER);\
+if (GVAR(batchNetworkEvents)) then {\
+    [BATCH_TO_SERVER, BATCH_TYPE_EVENT, [name, params]] call FUNC(sendEventBatched)\
+} else {\
+    SYS_SEND_EVENT(params,name,publicVariableServer)\
+}
+#define SEND_EVENT_TO_CLIENT(params,name,client) SYS_RECORD_SEND([ARR_2(name,params)],name,client);\
+if (GVAR(batchNetworkEvents)) then {\
+    [client, BATCH_TYPE_EVENT, [name, params]] call FUNC(sendEventBatched)\
+} else {\
+    SYS_SEND_EVENT(params,name,client publicVariableClient)\
+}
 
 // target events
 #define TEVENT_PVAR CBAu
 #define TEVENT_PVAR_STR QUOTE(TEVENT_PVAR)
 
-#define SEND_TEVENT_TO_SERVER(params,name,targets) TEVENT_PVAR = [name, params, targets]; publicVariableServer TEVENT_PVAR_STR
+#define SEND_TEVENT_TO_SERVER(params,name,targets) SYS_RECORD_SEND([ARR_3(name,params,targets)],name,BATCH_TO_SERVER);\
+if (GVAR(batchNetworkEvents)) then {\
+    [BATCH_TO_SERVER, BATCH_TYPE_TEVENT, [name, params, targets]] call FUNC(sendEventBatched)\
+} else {\
+    TEVENT_PVAR = [name, params, targets]; publicVariableServer TEVENT_PVAR_STR\
+}
 
 // turret events
 #define TUEVENT_PVAR CBAv
 #define TUEVENT_PVAR_STR QUOTE(TUEVENT_PVAR)
 
-#define SEND_TUEVENT_TO_SERVER(params,name,vehicle,turret) TUEVENT_PVAR = [name, params, vehicle, turret]; publicVariableServer TUEVENT_PVAR_STR
+#define SEND_TUEVENT_TO_SERVER(params,name,vehicle,turret) SYS_RECORD_SEND([ARR_4(name,params,vehicle,turret)],name,BATCH_TO_SERVER);\
+if (GVAR(batchNetworkEvents)) then {\
+    [BATCH_TO_SERVER, BATCH_TYPE_TUEVENT, [name, params, vehicle, turret]] call FUNC(sendEventBatched)\
+} else {\
+    TUEVENT_PVAR = [name, params, vehicle, turret]; publicVariableServer TUEVENT_PVAR_STR\
+}
+
+// batched events, all messages of one frame to the same destination are sent as one array
+#define BEVENT_PVAR CBAb
+#define BEVENT_PVAR_STR QUOTE(BEVENT_PVAR)
+
+// destinations, numbers are client owner ids, strings so they can't collide with any owner id
+#define BATCH_TO_OTHERS "others"
+#define BATCH_TO_SERVER "server"
+
+// message types, the receiver hands them to the same function as the unbatched public variable event handlers
+#define BATCH_TYPE_EVENT 0
+#define BATCH_TYPE_TEVENT 1
+#define BATCH_TYPE_TUEVENT 2
+
+// handler lists are copy-on-write while they are raised, see CBA_fnc_addEventHandler
+#define SYS_CALL_EVENT(args,event) (call {\
+    private _eventEntry = GVAR(eventHandlers) getOrDefault [toLowerANSI event, [[], 0]];\
+    _eventEntry set [1, (_eventEntry select 1) + 1];\
+    private _eventReturn = {\
+        if !(isNil "_x") then {\
+            args call _x;\
+        };\
+    } forEach (_eventEntry select 0);\
+    _eventEntry set [1, (_eventEntry select 1) - 1];\
+    if (!isNil "_eventReturn") then {_eventReturn}\
+})
 
-#define CALL_EVENT(args,event) {\
-    if !(isNil "_x") then {\
-        args call _x;\
-    };\
-} forEach +([GVAR(eventNamespace) getVariable event] param [0, []]) // copy array so events can be removed while iterating safely
+#define CALL_EVENT(args,event) (if (EGVAR(common,profiling)) then {\
+    [args, event] call FUNC(callEventProfiled)\
+} else {\
+    SYS_CALL_EVENT(args,event)\
+})
 
 #define GETOBJ(obj) (if (obj isEqualType grpNull) then {leader obj} else {obj})
 
@@ -6,6 +6,7 @@ class CfgFunctions {
             PATHTO_FNC(globalSay3d);
             PATHTO_FNC(publicVariable);
             PATHTO_FNC(setVarNet);
+            PATHTO_FNC(setVarNetDelta);
         };
     };
 };
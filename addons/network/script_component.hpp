@@ -18,3 +18,14 @@
 #define BI_SEND_TO_ALL 0
 #define BI_SEND_TO_CLIENTS_ONLY -2
 #define BI_SEND_TO_SERVER_ONLY 2
+
+// broadcasts immediately or queues the variable for the next coalesced broadcast, see CBA_fnc_setVarNet
+#define SET_VAR_NET(object,varName,value) if (GVAR(setVarNetRate) > 0) then {\
+    object setVariable [varName, value];\
+    if (count GVAR(setVarNetQueue) == 0) then {\
+        [FUNC(flushSetVarNet), [], 1 / GVAR(setVarNetRate)] call CBA_fnc_waitAndExecute;\
+    };\
+    GVAR(setVarNetQueue) set [[ARR_2(hashValue object,varName)] joinString ":", [ARR_3(object,varName,value)]];\
+} else {\
+    object setVariable [varName, value, true];\
+}
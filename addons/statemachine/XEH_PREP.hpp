@@ -11,3 +11,5 @@ PREP(toString);
 PREP(updateList);
 
 PREP(dumpPerformanceCounters);
+PREP(enablePerformanceCounters);
+PREP(recordPerformanceCounter);
@@ -10,6 +10,9 @@ class MyAddon_Statemachine {
     // and code goes into strings.
     list = "allGroups select {!isPlayer leader _x}";
     skipNull = 1;
+    // Optional, list items processed per frame and time budget in milliseconds for more items
+    itemsPerFrame = 1;
+    timeBudget = 0;
 
     // States are just subclasses of the state machine
     class Initial {
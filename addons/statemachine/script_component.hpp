@@ -2,7 +2,6 @@
 #include "\x\cba\addons\main\script_mod.hpp"
 
 // #define DISABLE_COMPILE_CACHE
-// #define STATEMACHINE_PERFORMANCE_COUNTERS
 
 #ifdef DEBUG_ENABLED_STATEMACHINE
     #define DEBUG_MODE_FULL
@@ -14,6 +13,16 @@
 
 #include "\x\cba\addons\main\script_macros.hpp"
 
+// number of most recent run times kept per performance counter for percentiles
+#define PERFORMANCE_COUNTER_SAMPLES 1000
+
+// Values the clockwork needs every frame, stored in one array per state machine:
+// [list, tick, skipNull, stateVar, compiledStates, initialState, updateCode, itemsPerFrame, timeBudget, ID]
+#define CLOCKWORK_LIST 0
+#define CLOCKWORK_TICK 1
+#define CLOCKWORK_COMPILEDSTATES 4
+#define CLOCKWORK_INITIALSTATE 5
+
 #define TRANSITIONS(var) (var + "_transitions")
 #define EVENTTRANSITIONS(var) (var + "_eventTransitions")
 #define ONSTATE(var) (var + "_onState")
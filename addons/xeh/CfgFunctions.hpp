@@ -4,6 +4,7 @@ class CfgFunctions {
             PATHTO_FNC(isScheduled);
             PATHTO_FNC(isRecompileEnabled);
             PATHTO_FNC(addClassEventHandler);
+            PATHTO_FNC(addClassEventHandlers);
             PATHTO_FNC(init);
             PATHTO_FNC(initEvents);
             PATHTO_FNC(supportMonitor);